@@ -17,11 +17,12 @@ TEST_NAME=$(basename "$TEST_FILE" .strada)
 # Concatenate all source files with the test
 COMBINED="/tmp/${TEST_NAME}_combined.strada"
 
-# Build combined file: source files + test + compress (must be last due to package declaration)
+# Build combined file: source files + test + lib/*.strada (must be last due to package declarations)
 # cannoli_obj.strada must come before router.strada (router calls Cannoli::new)
 cat "$CANNOLI_DIR/src/config.strada" \
     "$CANNOLI_DIR/src/mime.strada" \
     "$CANNOLI_DIR/src/session.strada" \
+    "$CANNOLI_DIR/src/cache.strada" \
     "$CANNOLI_DIR/src/template.strada" \
     "$CANNOLI_DIR/src/validation.strada" \
     "$CANNOLI_DIR/src/request.strada" \
@@ -35,7 +36,16 @@ cat "$CANNOLI_DIR/src/config.strada" \
     "$CANNOLI_DIR/src/fastcgi.strada" \
     "$CANNOLI_DIR/src/app.strada" \
     "$TEST_FILE" \
-    "$CANNOLI_DIR/lib/compress.strada" > "$COMBINED"
+    "$CANNOLI_DIR/lib/compress.strada" \
+    "$CANNOLI_DIR/lib/dispatch_v2.strada" \
+    "$CANNOLI_DIR/lib/sysutil.strada" \
+    "$CANNOLI_DIR/lib/shm.strada" \
+    "$CANNOLI_DIR/lib/crypto.strada" \
+    "$CANNOLI_DIR/lib/json.strada" \
+    "$CANNOLI_DIR/lib/url.strada" \
+    "$CANNOLI_DIR/lib/http.strada" \
+    "$CANNOLI_DIR/lib/ws.strada" \
+    "$CANNOLI_DIR/lib/fcgi.strada" > "$COMBINED"
 
 # Compile using $STRADA (defaults to the installed strada)
 STRADA="${STRADA:-strada}"
@@ -0,0 +1,87 @@
+/*
+ This file is part of the Strada Language (https://github.com/mjflick/strada-lang).
+ Copyright (c) 2026 Michael J. Flickinger
+ 
+ This program is free software: you can redistribute it and/or modify  
+ it under the terms of the GNU General Public License as published by  
+ the Free Software Foundation, version 2.
+
+ This program is distributed in the hope that it will be useful, but 
+ WITHOUT ANY WARRANTY; without even the implied warranty of 
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ General Public License for more details.
+
+ You should have received a copy of the GNU General Public License 
+ along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+ * cannoli_v2.h - Native dispatch interface for Cannoli libraries
+ *
+ * A library exporting cannoli_dispatch_v2() is called with a plain C view of
+ * the request (pointer/length pairs, not NUL-terminated, valid only for the
+ * duration of the call) and fills in a response struct. No Strada values are
+ * built and no string protocol is parsed.
+ *
+ * Return 0 (or leave status at 0) to decline the request.
+ * Body and header memory stays owned by the library; if free_fn is set it is
+ * called with free_ctx once Cannoli has copied the response.
+ */
+
+#ifndef CANNOLI_V2_H
+#define CANNOLI_V2_H
+
+#include <stddef.h>
+
+#define CANNOLI_V2_MAX_RES_HEADERS 32
+
+typedef struct { const char *ptr; size_t len; } cannoli_str;
+typedef struct { cannoli_str name; cannoli_str value; } cannoli_header;
+
+typedef struct {
+    cannoli_str method;
+    cannoli_str path;
+    cannoli_str path_info;
+    cannoli_str query;
+    cannoli_str body;
+    cannoli_str remote_addr;
+    const cannoli_header *headers;
+    size_t num_headers;
+} cannoli_request;
+
+typedef struct {
+    int status;
+    cannoli_header headers[CANNOLI_V2_MAX_RES_HEADERS];
+    size_t num_headers;
+    const char *body;
+    size_t body_len;
+    void (*free_fn)(void *ctx);
+    void *free_ctx;
+} cannoli_response;
+
+int cannoli_dispatch_v2(const cannoli_request *req, cannoli_response *res);
+
+/* Compare a cannoli_str with a C string literal */
+static inline int cannoli_str_eq(cannoli_str s, const char *lit) {
+    size_t n = 0;
+    while (lit[n]) n++;
+    if (s.len != n) return 0;
+    for (n = 0; n < s.len; n++) {
+        if (s.ptr[n] != lit[n]) return 0;
+    }
+    return 1;
+}
+
+static inline void cannoli_set_header(cannoli_response *res, const char *name, const char *value) {
+    size_t n = 0, v = 0;
+    if (res->num_headers >= CANNOLI_V2_MAX_RES_HEADERS) return;
+    while (name[n]) n++;
+    while (value[v]) v++;
+    res->headers[res->num_headers].name.ptr = name;
+    res->headers[res->num_headers].name.len = n;
+    res->headers[res->num_headers].value.ptr = value;
+    res->headers[res->num_headers].value.len = v;
+    res->num_headers++;
+}
+
+#endif
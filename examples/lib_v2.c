@@ -0,0 +1,60 @@
+/*
+ This file is part of the Strada Language (https://github.com/mjflick/strada-lang).
+ Copyright (c) 2026 Michael J. Flickinger
+ 
+ This program is free software: you can redistribute it and/or modify  
+ it under the terms of the GNU General Public License as published by  
+ the Free Software Foundation, version 2.
+
+ This program is distributed in the hope that it will be useful, but 
+ WITHOUT ANY WARRANTY; without even the implied warranty of 
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU 
+ General Public License for more details.
+
+ You should have received a copy of the GNU General Public License 
+ along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+ * lib_v2.c - Example library using the native cannoli_dispatch_v2 interface
+ * Routes: GET /v2/hello, POST /v2/echo
+ *
+ * Build: gcc -shared -fPIC -o examples/lib_v2.so examples/lib_v2.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cannoli_v2.h"
+
+const char* cannoli_routes(void) {
+    return "GET /v2/hello\n"
+           "POST /v2/echo\n";
+}
+
+int cannoli_dispatch_v2(const cannoli_request *req, cannoli_response *res) {
+    if (cannoli_str_eq(req->method, "GET") && cannoli_str_eq(req->path, "/v2/hello")) {
+        static const char body[] = "{\"message\":\"Hello from v2\"}";
+        res->status = 200;
+        cannoli_set_header(res, "Content-Type", "application/json");
+        res->body = body;
+        res->body_len = sizeof(body) - 1;
+        return 1;
+    }
+
+    if (cannoli_str_eq(req->method, "POST") && cannoli_str_eq(req->path, "/v2/echo")) {
+        /* Heap body released through free_fn once Cannoli has copied it */
+        char *copy = malloc(req->body.len + 1);
+        if (!copy) return 0;
+        memcpy(copy, req->body.ptr, req->body.len);
+        res->status = 200;
+        cannoli_set_header(res, "Content-Type", "text/plain");
+        res->body = copy;
+        res->body_len = req->body.len;
+        res->free_fn = free;
+        res->free_ctx = copy;
+        return 1;
+    }
+
+    return 0;
+}
@@ -146,10 +146,11 @@ sub _parse_query {
     return \%params;
 }
 
-# URL decode
+# URL decode (native decoder from the host binary when the bridge provides it)
 sub _url_decode {
     my ($s) = @_;
     return '' unless defined $s;
+    return _url_decode_xs($s) if defined &_url_decode_xs;
     $s =~ tr/+/ /;
     $s =~ s/%([0-9A-Fa-f]{2})/chr(hex($1))/eg;
     return $s;
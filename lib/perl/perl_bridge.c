@@ -31,10 +31,15 @@
 
 #include <EXTERN.h>
 #include <perl.h>
+#include <XSUB.h>
 
 /* Forward declaration - Strada runtime provides this */
 extern const char* strada_to_str(void *sv);
 
+/* URL decoder from lib/url.strada, exported by the cannoli binary. Weak so the
+ * bridge still loads in hosts without it; Cannoli.pm then falls back to Perl. */
+extern size_t cannoli_url_decode_buf(const char *s, size_t n, char *out) __attribute__((weak));
+
 /* Helper to safely get C string from StradaValue */
 static const char* sv_to_cstr(void *sv) {
     if (!sv) return NULL;
@@ -75,11 +80,30 @@ const char* perl_bridge_get_handler(void) {
  * module (IO, Cwd, DBI, ...). This is the standard perlembed pattern. */
 EXTERN_C void boot_DynaLoader(pTHX_ CV *cv);
 
+/* Cannoli::_url_decode_xs($s) - the native decoder behind Cannoli::_url_decode */
+XS(XS_Cannoli_url_decode) {
+    dXSARGS;
+    STRLEN len;
+    const char *src;
+    SV *out;
+    if (items != 1) croak_xs_usage(cv, "s");
+    src = SvPV(ST(0), len);
+    out = newSV(len + 1);
+    SvPOK_on(out);
+    SvCUR_set(out, cannoli_url_decode_buf(src, len, SvPVX(out)));
+    *SvEND(out) = '\0';
+    ST(0) = sv_2mortal(out);
+    XSRETURN(1);
+}
+
 static void xs_init(pTHX) {
     static const char file[] = __FILE__;
     dXSUB_SYS;
     PERL_UNUSED_CONTEXT;
     newXS("DynaLoader::boot_DynaLoader", boot_DynaLoader, file);
+    if (cannoli_url_decode_buf) {
+        newXS("Cannoli::_url_decode_xs", XS_Cannoli_url_decode, file);
+    }
 }
 
 /* Initialize the Perl interpreter (unused param for Strada FFI compatibility) */